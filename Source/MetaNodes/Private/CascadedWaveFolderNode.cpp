@@ -0,0 +1,283 @@
+#include "CascadedWaveFolderNode.h"
+#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
+#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+// #include "MetasoundStandardNodesNames.h"     // StandardNodes namespace
+#include "MetasoundFacade.h"                         // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+#include "MetasoundBuildError.h"             // FBuildErrorBase
+#include <algorithm>
+
+// Required for ensuring the node is supported by all languages in engine. Must be unique per MetaSound.
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_MetaSoundCascadedWaveFolderNode"
+
+namespace Metasound
+{
+    namespace CascadedWaveFolder
+    {
+        // Per-stage vertex names, indexed by stage.
+        static const FVertexName& GetGainName(int32 Stage)
+        {
+            static const FVertexName Names[MaxStages] =
+            {
+                METASOUND_GET_PARAM_NAME(InParamGain1), METASOUND_GET_PARAM_NAME(InParamGain2),
+                METASOUND_GET_PARAM_NAME(InParamGain3), METASOUND_GET_PARAM_NAME(InParamGain4),
+                METASOUND_GET_PARAM_NAME(InParamGain5), METASOUND_GET_PARAM_NAME(InParamGain6),
+                METASOUND_GET_PARAM_NAME(InParamGain7), METASOUND_GET_PARAM_NAME(InParamGain8)
+            };
+            return Names[Stage];
+        }
+
+        static const FVertexName& GetBiasName(int32 Stage)
+        {
+            static const FVertexName Names[MaxStages] =
+            {
+                METASOUND_GET_PARAM_NAME(InParamBias1), METASOUND_GET_PARAM_NAME(InParamBias2),
+                METASOUND_GET_PARAM_NAME(InParamBias3), METASOUND_GET_PARAM_NAME(InParamBias4),
+                METASOUND_GET_PARAM_NAME(InParamBias5), METASOUND_GET_PARAM_NAME(InParamBias6),
+                METASOUND_GET_PARAM_NAME(InParamBias7), METASOUND_GET_PARAM_NAME(InParamBias8)
+            };
+            return Names[Stage];
+        }
+
+        // Reported when the Stages input is outside [MinStages, MaxStages]. The operator still builds with the value clamped.
+        class FInvalidStageCountError : public FBuildErrorBase
+        {
+        public:
+            FInvalidStageCountError(const INode& InNode, int32 InNumStages)
+                : FBuildErrorBase("MetasoundCascadedWaveFolderInvalidStageCount",
+                    FText::Format(LOCTEXT("InvalidStageCount", "Stages must be between {0} and {1}, got {2}. The stage count is read once when the node is created."), MinStages, MaxStages, InNumStages))
+            {
+                AddNode(InNode);
+            }
+        };
+
+        // Feed-forward half of a fold stage: Out[i] = FastTanh(x) - Depth * Sin(SinScale * x), with x = Gain * In[i] + Bias.
+        // None of it depends on the stage's feedback, so it runs 4 samples at a time. In and Out may alias.
+        static void FoldFeedForward(const float* In, float* Out, int32 Num, float Gain, float Bias, float Depth, float SinScale)
+        {
+            const VectorRegister4Float GainV = VectorSetFloat1(Gain);
+            const VectorRegister4Float BiasV = VectorSetFloat1(Bias);
+            const VectorRegister4Float DepthV = VectorSetFloat1(Depth);
+            const VectorRegister4Float SinScaleV = VectorSetFloat1(SinScale);
+            const VectorRegister4Float TanhLimit = VectorSetFloat1(3.0f);
+            const VectorRegister4Float NegTanhLimit = VectorSetFloat1(-3.0f);
+            const VectorRegister4Float TwentySeven = VectorSetFloat1(27.0f);
+            const VectorRegister4Float Nine = VectorSetFloat1(9.0f);
+
+            const int32 NumVectorized = Num - (Num % 4);
+            for (int32 i = 0; i < NumVectorized; i += 4) {
+                const VectorRegister4Float X = VectorMultiplyAdd(VectorLoad(&In[i]), GainV, BiasV);
+
+                // Audio::FastTanh. Its +/-3 early outs become a clamp, the pade approximant is exactly +/-1 there.
+                const VectorRegister4Float Clamped = VectorMin(VectorMax(X, NegTanhLimit), TanhLimit);
+                const VectorRegister4Float Squared = VectorMultiply(Clamped, Clamped);
+                const VectorRegister4Float Tanh = VectorDivide(VectorMultiply(Clamped, VectorAdd(TwentySeven, Squared)), VectorMultiplyAdd(Nine, Squared, TwentySeven));
+
+                const VectorRegister4Float Fold = VectorMultiply(DepthV, VectorSin(VectorMultiply(SinScaleV, X)));
+                VectorStore(VectorSubtract(Tanh, Fold), &Out[i]);
+            }
+
+            for (int32 i = NumVectorized; i < Num; ++i) {
+                const float x = Gain * In[i] + Bias;
+                Out[i] = Audio::FastTanh(x) - Depth * FMath::Sin(SinScale * x);
+            }
+        }
+    }
+
+    // Implementation - Operator.
+    FCascadedWaveFolderOperator::FCascadedWaveFolderOperator(
+        const FOperatorSettings& InSettings,
+        const FAudioBufferReadRef& InAudioInput,
+        const FInt32ReadRef& InNumStages,
+        const FFloatReadRef& InDepth,
+        const FFloatReadRef& InFreq,
+        const FFloatReadRef& InFbDrive,
+        const TArray<FFloatReadRef>& InStageGains,
+        const TArray<FFloatReadRef>& InStageBiases)
+        : AudioInput(InAudioInput)
+        , NumStagesInput(InNumStages)
+        , Depth(InDepth)
+        , Freq(InFreq)
+        , FbDrive(InFbDrive)
+        , StageGains(InStageGains)
+        , StageBiases(InStageBiases)
+        , NumStages(FMath::Clamp(*InNumStages, CascadedWaveFolder::MinStages, CascadedWaveFolder::MaxStages))
+        , AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+    {
+        // Every stage's gain/bias ref exists regardless of NumStages, Execute indexes them by stage.
+        check(StageGains.Num() == CascadedWaveFolder::MaxStages && StageBiases.Num() == CascadedWaveFolder::MaxStages);
+    }
+
+    // Helper function for constructing vertex interface
+    const FVertexInterface& FCascadedWaveFolderOperator::GetVertexInterface()
+    {
+        using namespace CascadedWaveFolder;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAudioInput)),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNumStages), 4),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamDepth), 0.5f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFreq), 0.5f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFbDrive), 0.9f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain1), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain2), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain3), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain4), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain5), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain6), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain7), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamGain8), 1.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias1), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias2), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias3), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias4), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias5), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias6), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias7), 0.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamBias8), 0.0f)
+            ),
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+            )
+        );
+
+        return Interface;
+    }
+
+    // Retrieves necessary metadata about your node
+    const FNodeClassMetadata& FCascadedWaveFolderOperator::GetNodeInfo()
+    {
+        auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+        {
+            FVertexInterface NodeInterface = GetVertexInterface();
+
+            FNodeClassMetadata Metadata
+            {
+                FNodeClassName { StandardNodes::Namespace, "Cascaded Wave Folder Node", StandardNodes::AudioVariant },
+                1, // Major Version
+                0, // Minor Version
+                METASOUND_LOCTEXT("CascadedWaveFolderNodeDisplayName", "Cascaded Wave Folder Node"),
+                METASOUND_LOCTEXT("CascadedWaveFolderNodeDesc", "Runs 2-8 wavefolding stages back to back in a single node, with per-stage gain and bias. The stage count is read once when the node is created, changing it afterwards has no effect."),
+                PluginAuthor,
+                PluginNodeMissingPrompt,
+                NodeInterface,
+                { }, // Category Hierarchy
+                { }, // Keywords for searching
+                FNodeDisplayStyle{}
+            };
+
+            return Metadata;
+        };
+
+        static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+        return Metadata;
+    }
+
+    // Allows MetaSound graph to interact with your node's inputs
+    FDataReferenceCollection FCascadedWaveFolderOperator::GetInputs() const
+    {
+        using namespace CascadedWaveFolder;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAudioInput), FAudioBufferReadRef(AudioInput));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNumStages), FInt32ReadRef(NumStagesInput));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamDepth), FFloatReadRef(Depth));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFreq), FFloatReadRef(Freq));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamFbDrive), FFloatReadRef(FbDrive));
+
+        for (int32 Stage = 0; Stage < MaxStages; ++Stage) {
+            InputDataReferences.AddDataReadReference(GetGainName(Stage), FFloatReadRef(StageGains[Stage]));
+            InputDataReferences.AddDataReadReference(GetBiasName(Stage), FFloatReadRef(StageBiases[Stage]));
+        }
+
+        return InputDataReferences;
+    }
+
+    // Allows MetaSound graph to interact with your node's outputs
+    FDataReferenceCollection FCascadedWaveFolderOperator::GetOutputs() const
+    {
+        using namespace CascadedWaveFolder;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+
+        return OutputDataReferences;
+    }
+
+    // Used to instantiate a new runtime instance of your node
+    TUniquePtr<IOperator> FCascadedWaveFolderOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace CascadedWaveFolder;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamAudioInput), InParams.OperatorSettings);
+        FInt32ReadRef NumStages = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNumStages), InParams.OperatorSettings);
+        FFloatReadRef Depth = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamDepth), InParams.OperatorSettings);
+        FFloatReadRef Freq = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamFreq), InParams.OperatorSettings);
+        FFloatReadRef FbDrive = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamFbDrive), InParams.OperatorSettings);
+
+        if (*NumStages < MinStages || *NumStages > MaxStages) {
+            OutErrors.Add(MakeUnique<FInvalidStageCountError>(InParams.Node, *NumStages));
+        }
+
+        TArray<FFloatReadRef> StageGains;
+        TArray<FFloatReadRef> StageBiases;
+        for (int32 Stage = 0; Stage < MaxStages; ++Stage) {
+            StageGains.Add(InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, GetGainName(Stage), InParams.OperatorSettings));
+            StageBiases.Add(InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, GetBiasName(Stage), InParams.OperatorSettings));
+        }
+
+        return MakeUnique<FCascadedWaveFolderOperator>(InParams.OperatorSettings, AudioIn, NumStages, Depth, Freq, FbDrive, StageGains, StageBiases);
+    }
+
+    // Primary node functionality
+    void FCascadedWaveFolderOperator::Execute()
+    {
+        const float* InputAudio = AudioInput->GetData();
+        float* OutputAudio = AudioOutput->GetData();
+        const int NumFrames = AudioInput->Num();
+
+        // Read params once per block rather than once per sample per stage.
+        const float DepthValue = *Depth;
+        const float DriveValue = *FbDrive;
+        // Same as UE_TWO_PI * x * (Freq * (SampleRate / 2)) / SampleRate in the single stage folder.
+        const float SinScale = UE_PI * std::max(*Freq, 0.00001f);
+
+        // Run each stage over the whole block before moving on to the next. The first stage reads the
+        // input buffer, every later stage folds the output buffer in place so the block stays in cache.
+        const float* StageInput = InputAudio;
+        for (int32 Stage = 0; Stage < NumStages; ++Stage) {
+            CascadedWaveFolder::FoldFeedForward(StageInput, OutputAudio, NumFrames, *StageGains[Stage], *StageBiases[Stage], DepthValue, SinScale);
+
+            // Only the feedback term is recursive, so this is all that's left per sample.
+            float outputMinusOne = StageOutputMinusOne[Stage];
+            for (int i = 0; i < NumFrames; ++i) {
+                float fb = Audio::FastTanh(outputMinusOne);
+                float output = OutputAudio[i] + DriveValue * fb;
+
+                OutputAudio[i] = output / (1.0f + fb);
+                outputMinusOne = output;
+            }
+
+            StageOutputMinusOne[Stage] = outputMinusOne;
+            StageInput = OutputAudio;
+        }
+    }
+
+    // Implementation - Facade.
+    FCascadedWaveFolderNode::FCascadedWaveFolderNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FCascadedWaveFolderOperator>())
+    {
+    }
+
+    // Register node
+    METASOUND_REGISTER_NODE(FCascadedWaveFolderNode);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -138,24 +138,28 @@ namespace Metasound
         
         const float* AmpEnvBuffer = AmpEnv->GetData();
         
+        // Params only change between blocks, so read them once up front.
+        const float BaseFreq = *Frequency;
+        const float modAmp = BaseFreq * *MRatio * *ModIndex * *ModEnv;
+        const float carrBaseFreq = BaseFreq * *CRatio;
+        modPhaseInc = UE_TWO_PI * ((BaseFreq * *MRatio) / SampleRate);
+        
         for (int i = 0; i < NumFrames; ++i) {
             // Short ciruit and save cycles if Amplitude Envelope near 0.
             if ( AmpEnvBuffer[i] < 0.000001f ) {
                 OutputAudio[i] = 0;
             }
             
-            // Calculate modulator frequency and amount.
-            float modAmp = *Frequency * *MRatio * *ModIndex * *ModEnv;
+            // Calculate modulator frequency.
             float modFreq = modAmp * FMath::Sin(modPhase);
             
             // Write out to buffer.
             OutputAudio[i] = AmpEnvBuffer[i] * FMath::Sin(carrPhase);
             
-            float carrierFreq = *Frequency * *CRatio + modFreq;
+            float carrierFreq = carrBaseFreq + modFreq;
             
-            // Update phase increments.
+            // Update carrier phase increment.
             carrPhaseInc = UE_TWO_PI * (carrierFreq / SampleRate);
-            modPhaseInc = UE_TWO_PI * ((*Frequency * *MRatio) / SampleRate);
             
             // Increment modulator phase.
             IncrementPhase(modPhase, modPhaseInc);
@@ -0,0 +1,266 @@
+#include "FMVoicePoolNode.h"
+#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
+#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+// #include "MetasoundStandardNodesNames.h"     // StandardNodes namespace
+#include "MetasoundFacade.h"                         // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+#include "MetasoundBuildError.h"             // FBuildErrorBase
+#include "Async/ParallelFor.h"               // ParallelFor, EParallelForFlags
+#include "Async/TaskGraphInterfaces.h"       // FTaskGraphInterface
+
+// Required for ensuring the node is supported by all languages in engine. Must be unique per MetaSound.
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_MetaSoundFMVoicePool"
+
+namespace Metasound
+{
+    namespace FMVoicePool
+    {
+        // Per-voice vertex names, indexed by voice.
+        static const FVertexName& GetFrequencyName(int32 Voice)
+        {
+            static const FVertexName Names[MaxVoices] =
+            {
+                METASOUND_GET_PARAM_NAME(InParamFrequency1), METASOUND_GET_PARAM_NAME(InParamFrequency2),
+                METASOUND_GET_PARAM_NAME(InParamFrequency3), METASOUND_GET_PARAM_NAME(InParamFrequency4),
+                METASOUND_GET_PARAM_NAME(InParamFrequency5), METASOUND_GET_PARAM_NAME(InParamFrequency6),
+                METASOUND_GET_PARAM_NAME(InParamFrequency7), METASOUND_GET_PARAM_NAME(InParamFrequency8),
+                METASOUND_GET_PARAM_NAME(InParamFrequency9), METASOUND_GET_PARAM_NAME(InParamFrequency10),
+                METASOUND_GET_PARAM_NAME(InParamFrequency11), METASOUND_GET_PARAM_NAME(InParamFrequency12),
+                METASOUND_GET_PARAM_NAME(InParamFrequency13), METASOUND_GET_PARAM_NAME(InParamFrequency14),
+                METASOUND_GET_PARAM_NAME(InParamFrequency15), METASOUND_GET_PARAM_NAME(InParamFrequency16)
+            };
+            return Names[Voice];
+        }
+
+        // Reported when the Voices input is outside [MinVoices, MaxVoices]. The operator still builds with the value clamped.
+        class FInvalidVoiceCountError : public FBuildErrorBase
+        {
+        public:
+            FInvalidVoiceCountError(const INode& InNode, int32 InNumVoices)
+                : FBuildErrorBase("MetasoundFMVoicePoolInvalidVoiceCount",
+                    FText::Format(LOCTEXT("InvalidVoiceCount", "Voices must be between {0} and {1}, got {2}. The voice count is read once when the node is created."), MinVoices, MaxVoices, InNumVoices))
+            {
+                AddNode(InNode);
+            }
+        };
+    }
+
+    // Implementation - Operator.
+    FFMVoicePoolOperator::FFMVoicePoolOperator(
+        const FOperatorSettings& InSettings,
+        const FInt32ReadRef& InNumVoices,
+        const FBoolReadRef& InParallel,
+        const TArray<FFloatReadRef>& InFrequencies,
+        const FInt32ReadRef& InMRatio,
+        const FInt32ReadRef& InCRatio,
+        const FInt32ReadRef& InModIndex,
+        const FFloatReadRef& InModEnv,
+        const FAudioBufferReadRef& InAmpEnv)
+        : NumVoicesInput(InNumVoices)
+        , Parallel(InParallel)
+        , Frequencies(InFrequencies)
+        , MRatio(InMRatio)
+        , CRatio(InCRatio)
+        , ModIndex(InModIndex)
+        , ModEnv(InModEnv)
+        , AmpEnv(InAmpEnv)
+        , NumVoices(FMath::Clamp(*InNumVoices, FMVoicePool::MinVoices, FMVoicePool::MaxVoices))
+        , AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+    {
+        check(Frequencies.Num() == FMVoicePool::MaxVoices);
+
+        // One job per worker plus the render thread, which runs a job itself while it waits.
+        NumJobs = FMath::Clamp(FTaskGraphInterface::Get().GetNumWorkerThreads() + 1, 1, NumVoices);
+        NumFrames = AudioOutput->Num();
+
+        for (int32 Voice = 0; Voice < NumVoices; ++Voice) {
+            Voices.Add(MakeUnique<FFMGeneratorOperator>(InSettings, Frequencies[Voice], MRatio, CRatio, ModIndex, ModEnv, AmpEnv));
+            VoiceOutputs.Add(Voices.Last()->GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(FMGenerator::OutParamAudio)));
+        }
+
+        // Allocated up front so Execute never allocates.
+        JobMix.SetNumZeroed(NumJobs * NumFrames);
+    }
+
+    // Helper function for constructing vertex interface
+    const FVertexInterface& FFMVoicePoolOperator::GetVertexInterface()
+    {
+        using namespace FMVoicePool;
+
+        static const FVertexInterface Interface(
+            FInputVertexInterface(
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNumVoices), 4),
+                TInputDataVertexModel<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamParallel), false),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamMRatio), 1),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamCRatio), 1),
+                TInputDataVertexModel<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamModIndex), 1),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamModEnv), 1.0f),
+                TInputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamAmpEnv)),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency1), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency2), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency3), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency4), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency5), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency6), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency7), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency8), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency9), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency10), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency11), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency12), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency13), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency14), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency15), 440.0f),
+                TInputDataVertexModel<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamFrequency16), 440.0f)
+            ),
+            FOutputVertexInterface(
+                TOutputDataVertexModel<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamAudio))
+            )
+        );
+
+        return Interface;
+    }
+
+    // Retrieves necessary metadata about your node
+    const FNodeClassMetadata& FFMVoicePoolOperator::GetNodeInfo()
+    {
+        auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+        {
+            FVertexInterface NodeInterface = GetVertexInterface();
+
+            FNodeClassMetadata Metadata
+            {
+                FNodeClassName { StandardNodes::Namespace, "FM Voice Pool Node", StandardNodes::AudioVariant },
+                1, // Major Version
+                0, // Minor Version
+                METASOUND_LOCTEXT("FMVoicePoolNodeDisplayName", "FM Voice Pool Node"),
+                METASOUND_LOCTEXT("FMVoicePoolNodeDesc", "Renders 1-16 FM voices and mixes them down, optionally spread across worker threads. The voice count is read once when the node is created, changing it afterwards has no effect."),
+                PluginAuthor,
+                PluginNodeMissingPrompt,
+                NodeInterface,
+                { }, // Category Hierarchy
+                { }, // Keywords for searching
+                FNodeDisplayStyle{}
+            };
+
+            return Metadata;
+        };
+
+        static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+        return Metadata;
+    }
+
+    // Allows MetaSound graph to interact with your node's inputs
+    FDataReferenceCollection FFMVoicePoolOperator::GetInputs() const
+    {
+        using namespace FMVoicePool;
+
+        FDataReferenceCollection InputDataReferences;
+
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamNumVoices), FInt32ReadRef(NumVoicesInput));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamParallel), FBoolReadRef(Parallel));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamMRatio), FInt32ReadRef(MRatio));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamCRatio), FInt32ReadRef(CRatio));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamModIndex), FInt32ReadRef(ModIndex));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamModEnv), FFloatReadRef(ModEnv));
+        InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InParamAmpEnv), FAudioBufferReadRef(AmpEnv));
+
+        for (int32 Voice = 0; Voice < MaxVoices; ++Voice) {
+            InputDataReferences.AddDataReadReference(GetFrequencyName(Voice), FFloatReadRef(Frequencies[Voice]));
+        }
+
+        return InputDataReferences;
+    }
+
+    // Allows MetaSound graph to interact with your node's outputs
+    FDataReferenceCollection FFMVoicePoolOperator::GetOutputs() const
+    {
+        using namespace FMVoicePool;
+
+        FDataReferenceCollection OutputDataReferences;
+
+        OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutParamAudio), FAudioBufferReadRef(AudioOutput));
+
+        return OutputDataReferences;
+    }
+
+    // Used to instantiate a new runtime instance of your node
+    TUniquePtr<IOperator> FFMVoicePoolOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+    {
+        using namespace FMVoicePool;
+
+        const FDataReferenceCollection& InputCollection = InParams.InputDataReferences;
+        const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+        FInt32ReadRef NumVoices = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNumVoices), InParams.OperatorSettings);
+        FBoolReadRef Parallel = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<bool>(InputInterface, METASOUND_GET_PARAM_NAME(InParamParallel), InParams.OperatorSettings);
+        FInt32ReadRef MRatio = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamMRatio), InParams.OperatorSettings);
+        FInt32ReadRef CRatio = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamCRatio), InParams.OperatorSettings);
+        FInt32ReadRef ModIndex = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamModIndex), InParams.OperatorSettings);
+        FFloatReadRef ModEnv = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamModEnv), InParams.OperatorSettings);
+        FAudioBufferReadRef AmpEnv = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FAudioBuffer>(InputInterface, METASOUND_GET_PARAM_NAME(InParamAmpEnv), InParams.OperatorSettings);
+
+        if (*NumVoices < MinVoices || *NumVoices > MaxVoices) {
+            OutErrors.Add(MakeUnique<FInvalidVoiceCountError>(InParams.Node, *NumVoices));
+        }
+
+        TArray<FFloatReadRef> Frequencies;
+        for (int32 Voice = 0; Voice < MaxVoices; ++Voice) {
+            Frequencies.Add(InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, GetFrequencyName(Voice), InParams.OperatorSettings));
+        }
+
+        return MakeUnique<FFMVoicePoolOperator>(InParams.OperatorSettings, NumVoices, Parallel, Frequencies, MRatio, CRatio, ModIndex, ModEnv, AmpEnv);
+    }
+
+    // Renders this job's voices and sums them into its slice of JobMix. Jobs share no mutable state.
+    void FFMVoicePoolOperator::RenderJob(int32 Job)
+    {
+        float* Mix = JobMix.GetData() + Job * NumFrames;
+        FMemory::Memzero(Mix, NumFrames * sizeof(float));
+
+        for (int32 Voice = Job; Voice < NumVoices; Voice += NumJobs) {
+            Voices[Voice]->Execute();
+
+            const float* VoiceAudio = VoiceOutputs[Voice]->GetData();
+            for (int i = 0; i < NumFrames; ++i) {
+                Mix[i] += VoiceAudio[i];
+            }
+        }
+    }
+
+    void FFMVoicePoolOperator::Execute()
+    {
+        // Jobs are claimed off ParallelFor's atomic counter, and it only returns once every job is done, which is the
+        // barrier before the mix-down. With Parallel off the same jobs run in order on the render thread, so both modes
+        // sum in the same order and produce identical output.
+        const EParallelForFlags Flags = *Parallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+        ParallelFor(NumJobs, [this](int32 Job) { RenderJob(Job); }, Flags);
+
+        float* OutputAudio = AudioOutput->GetData();
+        const float Scale = 1.0f / NumVoices;
+
+        FMemory::Memcpy(OutputAudio, JobMix.GetData(), NumFrames * sizeof(float));
+        for (int32 Job = 1; Job < NumJobs; ++Job) {
+            const float* Mix = JobMix.GetData() + Job * NumFrames;
+            for (int i = 0; i < NumFrames; ++i) {
+                OutputAudio[i] += Mix[i];
+            }
+        }
+
+        for (int i = 0; i < NumFrames; ++i) {
+            OutputAudio[i] *= Scale;
+        }
+    }
+
+    // Implementation - Facade.
+    FFMVoicePoolNode::FFMVoicePoolNode(const FNodeInitData& InitData)
+        : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FFMVoicePoolOperator>())
+    {
+    }
+
+    // Register node
+    METASOUND_REGISTER_NODE(FFMVoicePoolNode);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,548 @@
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
+#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundAudioBuffer.h"            // FAudioBuffer
+#include "MetasoundFacade.h"                 // FNodeFacade class
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+#include "FMGeneratorNode.h"
+#include "WaveFolderNode.h"
+#include "CascadedWaveFolderNode.h"
+#include "FMVoicePoolNode.h"
+#include <algorithm>
+#include <cmath>
+
+// Accuracy vs speed checks for the fast DSP paths. Each test renders a scalar reference path (std::tanh / std::sin)
+// and the node's own operator from the same input, reports SNR, max abs error, THD+N, aliasing energy and ns/sample,
+// and fails when an accuracy metric crosses its threshold. Timings are reported but not gated. The thresholds were
+// calibrated against a standalone reimplementation of these paths, rebaseline them from the first engine run's output.
+// Run headless with:
+//   UnrealEditor-Cmd <project> -ExecCmds="Automation RunTests MetaNodes; Quit" -nullrhi -unattended -testexit="Automation Test Queue Empty"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MetaNodesDspTests
+{
+    using namespace Metasound;
+
+    constexpr int32 SampleRate = 48000;
+    constexpr float BlockRate = 100.0f;         // 480 frame blocks.
+    constexpr int32 NumWarmupBlocks = 20;       // Lets the feedback paths settle before analysis.
+    constexpr int32 NumAnalysisBlocks = 10;     // 4800 samples, 10 Hz bins.
+    constexpr int32 FundamentalBin = 127;       // 1270 Hz sits exactly on a bin, its aliases land between harmonics.
+    constexpr float TestToneFreq = 1270.0f;
+    constexpr float TestToneAmp = 0.8f;
+    constexpr int32 NumTimingBlocks = 2000;
+    constexpr int32 NumTimingTrials = 5;
+
+    struct FAccuracyReport
+    {
+        double SnrDb = 0.0;
+        double MaxAbsError = 0.0;
+        double RefThdnDb = 0.0;
+        double FastThdnDb = 0.0;
+        double RefAliasingDb = 0.0;
+        double FastAliasingDb = 0.0;
+        double RefNsPerSample = 0.0;
+        double FastNsPerSample = 0.0;
+    };
+
+    struct FAccuracyThresholds
+    {
+        double MinSnrDb;
+        double MaxAbsError;
+        double MaxThdnDeltaDb;          // |fast THD+N - ref THD+N|
+        double MaxAliasingIncreaseDb;   // fast aliasing energy - ref aliasing energy
+    };
+
+    static void FillTestTone(float* Buffer, int32 NumFrames, int32 StartFrame)
+    {
+        for (int32 i = 0; i < NumFrames; ++i) {
+            Buffer[i] = TestToneAmp * (float) std::sin(2.0 * UE_DOUBLE_PI * TestToneFreq * (double) (StartFrame + i) / SampleRate);
+        }
+    }
+
+    // Hann windowed DFT of the analysis window. THD+N is everything but the fundamental relative to the fundamental,
+    // aliasing is the energy outside the fundamental's harmonic bins relative to the total. DC is ignored.
+    static void MeasureSpectrum(const TArray<float>& Signal, double& OutThdnDb, double& OutAliasingDb)
+    {
+        const int32 Num = Signal.Num();
+        TArray<double> Windowed, Cos, Sin;
+        Windowed.SetNumUninitialized(Num);
+        Cos.SetNumUninitialized(Num);
+        Sin.SetNumUninitialized(Num);
+        for (int32 n = 0; n < Num; ++n) {
+            Cos[n] = std::cos(2.0 * UE_DOUBLE_PI * n / Num);
+            Sin[n] = std::sin(2.0 * UE_DOUBLE_PI * n / Num);
+            Windowed[n] = Signal[n] * (0.5 - 0.5 * Cos[n]);
+        }
+
+        double Total = 0.0;
+        double Fundamental = 0.0;
+        double NonHarmonic = 0.0;
+        for (int32 k = 3; k <= Num / 2; ++k) {
+            double Re = 0.0;
+            double Im = 0.0;
+            for (int32 n = 0; n < Num; ++n) {
+                const int32 Index = (int32) (((int64) k * n) % Num);
+                Re += Windowed[n] * Cos[Index];
+                Im -= Windowed[n] * Sin[Index];
+            }
+            const double Power = Re * Re + Im * Im;
+
+            // Hann main lobe is +/-2 bins.
+            const int32 Harmonic = (k + FundamentalBin / 2) / FundamentalBin;
+            const bool bIsHarmonic = Harmonic >= 1 && FMath::Abs(k - Harmonic * FundamentalBin) <= 2;
+
+            Total += Power;
+            if (bIsHarmonic && Harmonic == 1) {
+                Fundamental += Power;
+            }
+            if (!bIsHarmonic) {
+                NonHarmonic += Power;
+            }
+        }
+
+        OutThdnDb = 10.0 * std::log10((Total - Fundamental) / Fundamental);
+        OutAliasingDb = 10.0 * std::log10(NonHarmonic / Total);
+    }
+
+    static FAccuracyReport Compare(const TArray<float>& Reference, const TArray<float>& Fast)
+    {
+        FAccuracyReport Report;
+
+        double SignalPower = 0.0;
+        double ErrorPower = 0.0;
+        for (int32 i = 0; i < Reference.Num(); ++i) {
+            const double Error = (double) Reference[i] - Fast[i];
+            SignalPower += (double) Reference[i] * Reference[i];
+            ErrorPower += Error * Error;
+            // Not std::max, so a NaN sample carries through to the report.
+            if (!(std::abs(Error) <= Report.MaxAbsError)) {
+                Report.MaxAbsError = std::abs(Error);
+            }
+        }
+        Report.SnrDb = 10.0 * std::log10(SignalPower / std::max(ErrorPower, 1e-30));
+
+        MeasureSpectrum(Reference, Report.RefThdnDb, Report.RefAliasingDb);
+        MeasureSpectrum(Fast, Report.FastThdnDb, Report.FastAliasingDb);
+
+        return Report;
+    }
+
+    // Renders both paths block by block and keeps the analysis window of each. InputData, when set, gets the test tone
+    // before every block. Generators pass nullptr.
+    static void RenderPaths(float* InputData, int32 NumFrames, TFunctionRef<const float*()> RenderReference, TFunctionRef<const float*()> RenderFast, TArray<float>& OutReference, TArray<float>& OutFast)
+    {
+        for (int32 Block = 0; Block < NumWarmupBlocks + NumAnalysisBlocks; ++Block) {
+            if (InputData != nullptr) {
+                FillTestTone(InputData, NumFrames, Block * NumFrames);
+            }
+            const float* Reference = RenderReference();
+            const float* Fast = RenderFast();
+
+            if (Block >= NumWarmupBlocks) {
+                OutReference.Append(Reference, NumFrames);
+                OutFast.Append(Fast, NumFrames);
+            }
+        }
+    }
+
+    // Times both paths with their trials interleaved, so load on the machine hits both alike. Best of several trials each.
+    static void MeasureNsPerSample(int32 NumFrames, TFunctionRef<const float*()> RenderReference, TFunctionRef<const float*()> RenderFast, FAccuracyReport& OutReport)
+    {
+        auto TimeTrial = [NumFrames](TFunctionRef<const float*()> RenderBlock) -> double
+        {
+            const double Start = FPlatformTime::Seconds();
+            for (int32 Block = 0; Block < NumTimingBlocks; ++Block) {
+                RenderBlock();
+            }
+            const double Elapsed = FPlatformTime::Seconds() - Start;
+            return Elapsed * 1e9 / ((double) NumTimingBlocks * NumFrames);
+        };
+
+        OutReport.RefNsPerSample = TNumericLimits<double>::Max();
+        OutReport.FastNsPerSample = TNumericLimits<double>::Max();
+        for (int32 Trial = 0; Trial < NumTimingTrials; ++Trial) {
+            OutReport.RefNsPerSample = std::min(OutReport.RefNsPerSample, TimeTrial(RenderReference));
+            OutReport.FastNsPerSample = std::min(OutReport.FastNsPerSample, TimeTrial(RenderFast));
+        }
+    }
+
+    static void CheckReport(FAutomationTestBase& Test, const TCHAR* Name, const FAccuracyReport& Report, const FAccuracyThresholds& Thresholds)
+    {
+        Test.AddInfo(FString::Printf(TEXT("%s: SNR %.2f dB, max abs error %.3g, THD+N ref %.2f dB / fast %.2f dB, aliasing ref %.2f dB / fast %.2f dB, ref %.2f ns/sample, fast %.2f ns/sample"),
+            Name, Report.SnrDb, Report.MaxAbsError, Report.RefThdnDb, Report.FastThdnDb, Report.RefAliasingDb, Report.FastAliasingDb, Report.RefNsPerSample, Report.FastNsPerSample));
+
+        // Written so that NaN from a blown up path fails every check.
+        Test.TestTrue(FString::Printf(TEXT("%s SNR >= %.1f dB"), Name, Thresholds.MinSnrDb), Report.SnrDb >= Thresholds.MinSnrDb);
+        Test.TestTrue(FString::Printf(TEXT("%s max abs error <= %.3g"), Name, Thresholds.MaxAbsError), Report.MaxAbsError <= Thresholds.MaxAbsError);
+        Test.TestTrue(FString::Printf(TEXT("%s THD+N delta <= %.2f dB"), Name, Thresholds.MaxThdnDeltaDb), std::abs(Report.FastThdnDb - Report.RefThdnDb) <= Thresholds.MaxThdnDeltaDb);
+        Test.TestTrue(FString::Printf(TEXT("%s aliasing increase <= %.2f dB"), Name, Thresholds.MaxAliasingIncreaseDb), Report.FastAliasingDb - Report.RefAliasingDb <= Thresholds.MaxAliasingIncreaseDb);
+    }
+
+    static float ReferenceTanh(float X)
+    {
+        return (float) std::tanh((double) X);
+    }
+
+    static float ReferenceSin(float X)
+    {
+        return (float) std::sin((double) X);
+    }
+
+    // FWaveFolderOperator::Execute with std::tanh in place of Audio::FastTanh.
+    struct FReferenceWaveFolder
+    {
+        float OutputMinusOne = 0.0f;
+
+        void Process(const float* In, float* Out, int32 Num, float Depth, float Freq, float Drive)
+        {
+            const float Rate = (float) SampleRate;
+            for (int32 i = 0; i < Num; ++i) {
+                float fb = ReferenceTanh(OutputMinusOne);
+                float satFactor = ReferenceTanh(In[i]) + Drive * fb;
+                float output = satFactor - Depth * ReferenceSin(UE_TWO_PI * In[i] * (std::max(Freq, 0.00001f) * (Rate / 2)) / Rate);
+
+                Out[i] = output / (1.0f + fb);
+                OutputMinusOne = output;
+            }
+        }
+    };
+
+    // FCascadedWaveFolderOperator::Execute as a plain per-sample loop with std::tanh and std::sin.
+    struct FReferenceCascadedWaveFolder
+    {
+        float StageOutputMinusOne[CascadedWaveFolder::MaxStages] = { };
+
+        void Process(const float* In, float* Out, int32 Num, int32 NumStages, const float* Gains, const float* Biases, float Depth, float Freq, float Drive)
+        {
+            const float SinScale = UE_PI * std::max(Freq, 0.00001f);
+            const float* StageInput = In;
+            for (int32 Stage = 0; Stage < NumStages; ++Stage) {
+                float outputMinusOne = StageOutputMinusOne[Stage];
+                for (int32 i = 0; i < Num; ++i) {
+                    const float x = Gains[Stage] * StageInput[i] + Biases[Stage];
+                    float fb = ReferenceTanh(outputMinusOne);
+                    float output = ReferenceTanh(x) + Drive * fb - Depth * ReferenceSin(SinScale * x);
+
+                    Out[i] = output / (1.0f + fb);
+                    outputMinusOne = output;
+                }
+                StageOutputMinusOne[Stage] = outputMinusOne;
+                StageInput = Out;
+            }
+        }
+    };
+
+    // FFMGeneratorOperator::Execute with std::sin in place of FMath::Sin.
+    struct FReferenceFMGenerator
+    {
+        float carrPhase = 0.0f;
+        float modPhase = 0.0f;
+
+        static void IncrementPhase(float& phase, float increment)
+        {
+            float nextPhase = phase + increment;
+            phase = nextPhase > UE_TWO_PI ? nextPhase - UE_TWO_PI : nextPhase;
+        }
+
+        void Process(float* Out, int32 Num, float Frequency, int32 MRatio, int32 CRatio, int32 ModIndex, float ModEnv)
+        {
+            const float modAmp = Frequency * MRatio * ModIndex * ModEnv;
+            const float carrBaseFreq = Frequency * CRatio;
+            const float modPhaseInc = UE_TWO_PI * ((Frequency * MRatio) / (float) SampleRate);
+
+            for (int32 i = 0; i < Num; ++i) {
+                float modFreq = modAmp * ReferenceSin(modPhase);
+                Out[i] = ReferenceSin(carrPhase);
+
+                float carrPhaseInc = UE_TWO_PI * ((carrBaseFreq + modFreq) / (float) SampleRate);
+                IncrementPhase(modPhase, modPhaseInc);
+                IncrementPhase(carrPhase, carrPhaseInc);
+            }
+        }
+    };
+
+    static TArray<FFloatReadRef> MakeFloatRefs(const float* Values, int32 Num)
+    {
+        TArray<FFloatReadRef> Refs;
+        for (int32 i = 0; i < Num; ++i) {
+            Refs.Add(FFloatReadRef::CreateNew(Values[i]));
+        }
+        return Refs;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaNodesWaveFolderAccuracyTest, "MetaNodes.Dsp.WaveFolder.Accuracy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMetaNodesWaveFolderAccuracyTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaNodesDspTests;
+
+    // Node defaults apart from Drive. At the default 0.9 the feedback loop grows FastTanh's per-sample error (SNR drops
+    // to about 18 dB), at 0.3 the number is mostly FastTanh itself.
+    const float Depth = 0.5f;
+    const float Freq = 0.5f;
+    const float Drive = 0.3f;
+
+    const FOperatorSettings Settings(SampleRate, BlockRate);
+    FAudioBufferWriteRef Input = FAudioBufferWriteRef::CreateNew(Settings);
+    const int32 NumFrames = Input->Num();
+
+    FWaveFolderOperator Operator(Settings, FAudioBufferReadRef(Input), FFloatReadRef::CreateNew(Depth), FFloatReadRef::CreateNew(Freq), FFloatReadRef::CreateNew(Drive));
+    const FAudioBufferReadRef Output = Operator.GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(WaveFolder::OutParamAudio));
+
+    FReferenceWaveFolder Reference;
+    TArray<float> ReferenceOutput;
+    ReferenceOutput.SetNumZeroed(NumFrames);
+
+    auto RenderReference = [&]() -> const float*
+    {
+        Reference.Process(Input->GetData(), ReferenceOutput.GetData(), NumFrames, Depth, Freq, Drive);
+        return ReferenceOutput.GetData();
+    };
+    auto RenderFast = [&]() -> const float*
+    {
+        Operator.Execute();
+        return Output->GetData();
+    };
+
+    TArray<float> ReferenceWindow, FastWindow;
+    RenderPaths(Input->GetData(), NumFrames, RenderReference, RenderFast, ReferenceWindow, FastWindow);
+
+    FAccuracyReport Report = Compare(ReferenceWindow, FastWindow);
+    MeasureNsPerSample(NumFrames, RenderReference, RenderFast, Report);
+
+    // Standalone run: 24.2 dB SNR, 0.028 max abs error, 0.76 dB THD+N delta, 2.5 dB more aliasing.
+    CheckReport(*this, TEXT("Wave Folder FastTanh"), Report, { 22.0, 0.05, 1.5, 6.0 });
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaNodesCascadedWaveFolderAccuracyTest, "MetaNodes.Dsp.CascadedWaveFolder.Accuracy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMetaNodesCascadedWaveFolderAccuracyTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaNodesDspTests;
+
+    // Drive is kept low: at higher drive several stages of feedback go chaotic and any two paths diverge.
+    const int32 NumStages = 4;
+    const float Depth = 0.5f;
+    const float Freq = 0.5f;
+    const float Drive = 0.3f;
+    const float Gains[CascadedWaveFolder::MaxStages] = { 1.0f, 1.5f, 0.8f, 1.2f, 1.0f, 1.0f, 1.0f, 1.0f };
+    const float Biases[CascadedWaveFolder::MaxStages] = { 0.0f, 0.1f, -0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    const FOperatorSettings Settings(SampleRate, BlockRate);
+    FAudioBufferWriteRef Input = FAudioBufferWriteRef::CreateNew(Settings);
+    const int32 NumFrames = Input->Num();
+
+    FCascadedWaveFolderOperator Operator(Settings, FAudioBufferReadRef(Input), FInt32ReadRef::CreateNew(NumStages),
+        FFloatReadRef::CreateNew(Depth), FFloatReadRef::CreateNew(Freq), FFloatReadRef::CreateNew(Drive),
+        MakeFloatRefs(Gains, CascadedWaveFolder::MaxStages), MakeFloatRefs(Biases, CascadedWaveFolder::MaxStages));
+    const FAudioBufferReadRef Output = Operator.GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(CascadedWaveFolder::OutParamAudio));
+
+    FReferenceCascadedWaveFolder Reference;
+    TArray<float> ReferenceOutput;
+    ReferenceOutput.SetNumZeroed(NumFrames);
+
+    auto RenderReference = [&]() -> const float*
+    {
+        Reference.Process(Input->GetData(), ReferenceOutput.GetData(), NumFrames, NumStages, Gains, Biases, Depth, Freq, Drive);
+        return ReferenceOutput.GetData();
+    };
+    auto RenderFast = [&]() -> const float*
+    {
+        Operator.Execute();
+        return Output->GetData();
+    };
+
+    TArray<float> ReferenceWindow, FastWindow;
+    RenderPaths(Input->GetData(), NumFrames, RenderReference, RenderFast, ReferenceWindow, FastWindow);
+
+    FAccuracyReport Report = Compare(ReferenceWindow, FastWindow);
+    MeasureNsPerSample(NumFrames, RenderReference, RenderFast, Report);
+
+    // Standalone run, with sinf standing in for VectorSin: 22.5 dB SNR, 0.0027 max abs error, 1.05 dB THD+N delta, 0.9 dB more aliasing.
+    CheckReport(*this, TEXT("Cascaded Wave Folder vector path"), Report, { 19.0, 0.01, 2.0, 6.0 });
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaNodesCascadedWaveFolderChainTest, "MetaNodes.Dsp.CascadedWaveFolder.MatchesChain", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMetaNodesCascadedWaveFolderChainTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaNodesDspTests;
+
+    // A cascade with unity gain and zero bias is the same math as the same number of chained Wave Folder nodes,
+    // so it should match them closely. The speed-up is reported rather than gated.
+    const int32 NumStages = 4;
+    const float Depth = 0.5f;
+    const float Freq = 0.5f;
+    const float Drive = 0.3f;
+    const float Gains[CascadedWaveFolder::MaxStages] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    const float Biases[CascadedWaveFolder::MaxStages] = { };
+
+    const FOperatorSettings Settings(SampleRate, BlockRate);
+    FAudioBufferWriteRef Input = FAudioBufferWriteRef::CreateNew(Settings);
+    const int32 NumFrames = Input->Num();
+
+    TArray<TUniquePtr<FWaveFolderOperator>> Chain;
+    FAudioBufferReadRef ChainInput(Input);
+    for (int32 Stage = 0; Stage < NumStages; ++Stage) {
+        Chain.Add(MakeUnique<FWaveFolderOperator>(Settings, ChainInput, FFloatReadRef::CreateNew(Depth), FFloatReadRef::CreateNew(Freq), FFloatReadRef::CreateNew(Drive)));
+        ChainInput = Chain.Last()->GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(WaveFolder::OutParamAudio));
+    }
+    const FAudioBufferReadRef ChainOutput = ChainInput;
+
+    FCascadedWaveFolderOperator Cascade(Settings, FAudioBufferReadRef(Input), FInt32ReadRef::CreateNew(NumStages),
+        FFloatReadRef::CreateNew(Depth), FFloatReadRef::CreateNew(Freq), FFloatReadRef::CreateNew(Drive),
+        MakeFloatRefs(Gains, CascadedWaveFolder::MaxStages), MakeFloatRefs(Biases, CascadedWaveFolder::MaxStages));
+    const FAudioBufferReadRef CascadeOutput = Cascade.GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(CascadedWaveFolder::OutParamAudio));
+
+    auto RenderChain = [&]() -> const float*
+    {
+        for (TUniquePtr<FWaveFolderOperator>& Operator : Chain) {
+            Operator->Execute();
+        }
+        return ChainOutput->GetData();
+    };
+    auto RenderCascade = [&]() -> const float*
+    {
+        Cascade.Execute();
+        return CascadeOutput->GetData();
+    };
+
+    TArray<float> ChainWindow, CascadeWindow;
+    RenderPaths(Input->GetData(), NumFrames, RenderChain, RenderCascade, ChainWindow, CascadeWindow);
+
+    FAccuracyReport Report = Compare(ChainWindow, CascadeWindow);
+    MeasureNsPerSample(NumFrames, RenderChain, RenderCascade, Report);
+
+    // Only VectorSin and the rearranged sine argument separate the two. Standalone run, with sinf standing in for
+    // VectorSin: 129 dB SNR, 1.5e-8 max abs error.
+    CheckReport(*this, TEXT("Cascaded Wave Folder vs chained Wave Folders"), Report, { 70.0, 1e-3, 0.1, 3.0 });
+    AddInfo(FString::Printf(TEXT("Cascade runs at %.2fx the chain's ns/sample"), Report.FastNsPerSample / Report.RefNsPerSample));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaNodesFMGeneratorAccuracyTest, "MetaNodes.Dsp.FMGenerator.Accuracy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMetaNodesFMGeneratorAccuracyTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaNodesDspTests;
+
+    // Integer ratios keep every sideband on a harmonic of the test tone.
+    const float Frequency = TestToneFreq;
+    const int32 MRatio = 2;
+    const int32 CRatio = 1;
+    const int32 ModIndex = 3;
+    const float ModEnv = 1.0f;
+
+    const FOperatorSettings Settings(SampleRate, BlockRate);
+    FAudioBufferWriteRef AmpEnv = FAudioBufferWriteRef::CreateNew(Settings);
+    const int32 NumFrames = AmpEnv->Num();
+    std::fill(AmpEnv->GetData(), AmpEnv->GetData() + NumFrames, 1.0f);
+
+    FFMGeneratorOperator Operator(Settings, FFloatReadRef::CreateNew(Frequency), FInt32ReadRef::CreateNew(MRatio), FInt32ReadRef::CreateNew(CRatio),
+        FInt32ReadRef::CreateNew(ModIndex), FFloatReadRef::CreateNew(ModEnv), FAudioBufferReadRef(AmpEnv));
+    const FAudioBufferReadRef Output = Operator.GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(FMGenerator::OutParamAudio));
+
+    FReferenceFMGenerator Reference;
+    TArray<float> ReferenceOutput;
+    ReferenceOutput.SetNumZeroed(NumFrames);
+
+    auto RenderReference = [&]() -> const float*
+    {
+        Reference.Process(ReferenceOutput.GetData(), NumFrames, Frequency, MRatio, CRatio, ModIndex, ModEnv);
+        return ReferenceOutput.GetData();
+    };
+    auto RenderFast = [&]() -> const float*
+    {
+        Operator.Execute();
+        return Output->GetData();
+    };
+
+    TArray<float> ReferenceWindow, FastWindow;
+    RenderPaths(nullptr, NumFrames, RenderReference, RenderFast, ReferenceWindow, FastWindow);
+
+    FAccuracyReport Report = Compare(ReferenceWindow, FastWindow);
+    MeasureNsPerSample(NumFrames, RenderReference, RenderFast, Report);
+
+    // Standalone run: 115.6 dB SNR, 2.4e-6 max abs error, no measurable THD+N or aliasing change.
+    CheckReport(*this, TEXT("FM Generator FMath::Sin"), Report, { 100.0, 1e-5, 0.01, 0.5 });
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetaNodesFMVoicePoolScalingTest, "MetaNodes.Dsp.FMVoicePool.Scaling", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMetaNodesFMVoicePoolScalingTest::RunTest(const FString& Parameters)
+{
+    using namespace MetaNodesDspTests;
+
+    const FOperatorSettings Settings(SampleRate, BlockRate);
+    FAudioBufferWriteRef AmpEnv = FAudioBufferWriteRef::CreateNew(Settings);
+    const int32 NumFrames = AmpEnv->Num();
+    std::fill(AmpEnv->GetData(), AmpEnv->GetData() + NumFrames, 1.0f);
+
+    float VoiceFrequencies[FMVoicePool::MaxVoices];
+    for (int32 Voice = 0; Voice < FMVoicePool::MaxVoices; ++Voice) {
+        VoiceFrequencies[Voice] = 110.0f * (Voice + 1);
+    }
+
+    const double BlockDeadlineNs = 1e9 * NumFrames / SampleRate;
+    const int32 VoiceCounts[] = { 1, 2, 4, 8, 16 };
+
+    for (const int32 NumVoices : VoiceCounts) {
+        auto MakePool = [&](bool bParallel)
+        {
+            return MakeUnique<FFMVoicePoolOperator>(Settings, FInt32ReadRef::CreateNew(NumVoices), FBoolReadRef::CreateNew(bParallel),
+                MakeFloatRefs(VoiceFrequencies, FMVoicePool::MaxVoices), FInt32ReadRef::CreateNew(2), FInt32ReadRef::CreateNew(1),
+                FInt32ReadRef::CreateNew(3), FFloatReadRef::CreateNew(1.0f), FAudioBufferReadRef(AmpEnv));
+        };
+        TUniquePtr<FFMVoicePoolOperator> SerialPool = MakePool(false);
+        TUniquePtr<FFMVoicePoolOperator> ParallelPool = MakePool(true);
+        const FAudioBufferReadRef SerialOutput = SerialPool->GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(FMVoicePool::OutParamAudio));
+        const FAudioBufferReadRef ParallelOutput = ParallelPool->GetOutputs().GetDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(FMVoicePool::OutParamAudio));
+
+        auto RenderSerial = [&]() -> const float*
+        {
+            SerialPool->Execute();
+            return SerialOutput->GetData();
+        };
+        auto RenderParallel = [&]() -> const float*
+        {
+            ParallelPool->Execute();
+            return ParallelOutput->GetData();
+        };
+
+        // Both modes sum in the same order, so the mix-down must match exactly.
+        TArray<float> SerialWindow, ParallelWindow;
+        RenderPaths(nullptr, NumFrames, RenderSerial, RenderParallel, SerialWindow, ParallelWindow);
+        TestTrue(FString::Printf(TEXT("%d voice parallel mix-down matches serial"), NumVoices),
+            FMemory::Memcmp(SerialWindow.GetData(), ParallelWindow.GetData(), SerialWindow.Num() * sizeof(float)) == 0);
+
+        FAccuracyReport Timing;
+        MeasureNsPerSample(NumFrames, RenderSerial, RenderParallel, Timing);
+
+        // Timings are reported, not gated: they depend on the machine's core count and load.
+        const int32 NumJobs = ParallelPool->GetNumJobs();
+        const double SerialBlockNs = Timing.RefNsPerSample * NumFrames;
+        const double ParallelBlockNs = Timing.FastNsPerSample * NumFrames;
+        const double SerialVoicesPerCore = NumVoices * BlockDeadlineNs / SerialBlockNs;
+        const double ParallelVoicesPerCore = NumVoices * BlockDeadlineNs / (ParallelBlockNs * NumJobs);
+        const double HandoffOverheadNs = ParallelBlockNs - SerialBlockNs / NumJobs;
+
+        AddInfo(FString::Printf(TEXT("FM Voice Pool, %d voices, %d jobs: serial %.1f us/block, parallel %.1f us/block (%.2fx), voices per core at the %.1f ms deadline: serial %.0f, parallel %.0f, handoff overhead %.1f us/block"),
+            NumVoices, NumJobs, SerialBlockNs / 1000.0, ParallelBlockNs / 1000.0, SerialBlockNs / ParallelBlockNs, BlockDeadlineNs / 1e6,
+            SerialVoicesPerCore, ParallelVoicesPerCore, HandoffOverheadNs / 1000.0));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+
+namespace Metasound {
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_MetaSoundCascadedWaveFolderNode"
+
+    // Vertex Names - define your node's inputs and outputs here
+    namespace CascadedWaveFolder
+    {
+        METASOUND_PARAM(InParamAudioInput, "In", "Audio input.");
+        METASOUND_PARAM(InParamNumStages, "Stages", "Number of folding stages (2-8). Read once when the node is created, later changes are ignored.");
+        METASOUND_PARAM(InParamDepth, "Depth", "Amount of saturation gain applied by each stage.");
+        METASOUND_PARAM(InParamFreq, "Frequency", "Saturation wave shape frequency.");
+        METASOUND_PARAM(InParamFbDrive, "Drive", "Feedback drive factor.");
+
+        // Per-stage gain and bias, applied to the signal going into each stage.
+        METASOUND_PARAM(InParamGain1, "Gain 1", "Stage 1 input gain.");
+        METASOUND_PARAM(InParamGain2, "Gain 2", "Stage 2 input gain.");
+        METASOUND_PARAM(InParamGain3, "Gain 3", "Stage 3 input gain.");
+        METASOUND_PARAM(InParamGain4, "Gain 4", "Stage 4 input gain.");
+        METASOUND_PARAM(InParamGain5, "Gain 5", "Stage 5 input gain.");
+        METASOUND_PARAM(InParamGain6, "Gain 6", "Stage 6 input gain.");
+        METASOUND_PARAM(InParamGain7, "Gain 7", "Stage 7 input gain.");
+        METASOUND_PARAM(InParamGain8, "Gain 8", "Stage 8 input gain.");
+
+        METASOUND_PARAM(InParamBias1, "Bias 1", "Stage 1 input bias.");
+        METASOUND_PARAM(InParamBias2, "Bias 2", "Stage 2 input bias.");
+        METASOUND_PARAM(InParamBias3, "Bias 3", "Stage 3 input bias.");
+        METASOUND_PARAM(InParamBias4, "Bias 4", "Stage 4 input bias.");
+        METASOUND_PARAM(InParamBias5, "Bias 5", "Stage 5 input bias.");
+        METASOUND_PARAM(InParamBias6, "Bias 6", "Stage 6 input bias.");
+        METASOUND_PARAM(InParamBias7, "Bias 7", "Stage 7 input bias.");
+        METASOUND_PARAM(InParamBias8, "Bias 8", "Stage 8 input bias.");
+
+        METASOUND_PARAM(OutParamAudio, "Out", "Audio output.")
+
+        constexpr int32 MinStages = 2;
+        constexpr int32 MaxStages = 8;
+    }
+
+#undef LOCTEXT_NAMESPACE
+
+    // Operator Declaration.
+    class FCascadedWaveFolderOperator : public TExecutableOperator<FCascadedWaveFolderOperator>
+    {
+    public:
+
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        FCascadedWaveFolderOperator(const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InAudioInput,
+            const FInt32ReadRef& InNumStages,
+            const FFloatReadRef& InDepth,
+            const FFloatReadRef& InFreq,
+            const FFloatReadRef& InFbDrive,
+            const TArray<FFloatReadRef>& InStageGains,
+            const TArray<FFloatReadRef>& InStageBiases);
+
+        virtual FDataReferenceCollection GetInputs() const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+        void Execute();
+
+    private:
+
+        // Params.
+        FAudioBufferReadRef AudioInput;
+        FInt32ReadRef NumStagesInput;
+        FFloatReadRef Depth;
+        FFloatReadRef Freq;
+        FFloatReadRef FbDrive;
+        TArray<FFloatReadRef> StageGains;
+        TArray<FFloatReadRef> StageBiases;
+
+        // Stage count is latched at creation.
+        int32 NumStages = CascadedWaveFolder::MinStages;
+
+        // Feedback state, one per stage.
+        float StageOutputMinusOne[CascadedWaveFolder::MaxStages] = { };
+
+        // Outputs
+        FAudioBufferWriteRef AudioOutput;
+    };
+
+    // Facade Declaration.
+    class FCascadedWaveFolderNode : public FNodeFacade
+    {
+    public:
+        // Constructor used by the Metasound Frontend.
+        FCascadedWaveFolderNode(const FNodeInitData& InitData);
+    };
+}
@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "FMGeneratorNode.h"
+
+namespace Metasound {
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_MetaSoundFMVoicePool"
+
+    // Vertex Names - define your node's inputs and outputs here
+    namespace FMVoicePool
+    {
+        METASOUND_PARAM(InParamNumVoices, "Voices", "Number of FM voices (1-16). Read once when the node is created, later changes are ignored.");
+        METASOUND_PARAM(InParamParallel, "Parallel", "Render groups of voices as jobs on worker threads instead of one after the other on the audio render thread.");
+        METASOUND_PARAM(InParamMRatio, "Mod Ratio", "Modulation Ratio, shared by every voice.");
+        METASOUND_PARAM(InParamCRatio, "Carrier Ratio", "Carrier Ratio, shared by every voice.");
+        METASOUND_PARAM(InParamModIndex, "Mod Index", "Modulation Index, shared by every voice.");
+        METASOUND_PARAM(InParamModEnv, "Mod Envelope", "Envelope applied to every voice's modulation osc.");
+        METASOUND_PARAM(InParamAmpEnv, "Amp Envelope", "Envelope applied to every voice's output.");
+
+        // Per-voice tone frequency.
+        METASOUND_PARAM(InParamFrequency1, "Frequency 1", "Voice 1 frequency.");
+        METASOUND_PARAM(InParamFrequency2, "Frequency 2", "Voice 2 frequency.");
+        METASOUND_PARAM(InParamFrequency3, "Frequency 3", "Voice 3 frequency.");
+        METASOUND_PARAM(InParamFrequency4, "Frequency 4", "Voice 4 frequency.");
+        METASOUND_PARAM(InParamFrequency5, "Frequency 5", "Voice 5 frequency.");
+        METASOUND_PARAM(InParamFrequency6, "Frequency 6", "Voice 6 frequency.");
+        METASOUND_PARAM(InParamFrequency7, "Frequency 7", "Voice 7 frequency.");
+        METASOUND_PARAM(InParamFrequency8, "Frequency 8", "Voice 8 frequency.");
+        METASOUND_PARAM(InParamFrequency9, "Frequency 9", "Voice 9 frequency.");
+        METASOUND_PARAM(InParamFrequency10, "Frequency 10", "Voice 10 frequency.");
+        METASOUND_PARAM(InParamFrequency11, "Frequency 11", "Voice 11 frequency.");
+        METASOUND_PARAM(InParamFrequency12, "Frequency 12", "Voice 12 frequency.");
+        METASOUND_PARAM(InParamFrequency13, "Frequency 13", "Voice 13 frequency.");
+        METASOUND_PARAM(InParamFrequency14, "Frequency 14", "Voice 14 frequency.");
+        METASOUND_PARAM(InParamFrequency15, "Frequency 15", "Voice 15 frequency.");
+        METASOUND_PARAM(InParamFrequency16, "Frequency 16", "Voice 16 frequency.");
+
+        METASOUND_PARAM(OutParamAudio, "Out", "Audio output.")
+
+        constexpr int32 MinVoices = 1;
+        constexpr int32 MaxVoices = 16;
+    }
+
+#undef LOCTEXT_NAMESPACE
+
+    // Operator Declaration.
+    class FFMVoicePoolOperator : public TExecutableOperator<FFMVoicePoolOperator>
+    {
+    public:
+
+        static const FNodeClassMetadata& GetNodeInfo();
+        static const FVertexInterface& GetVertexInterface();
+        static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+        FFMVoicePoolOperator(const FOperatorSettings& InSettings,
+            const FInt32ReadRef& InNumVoices,
+            const FBoolReadRef& InParallel,
+            const TArray<FFloatReadRef>& InFrequencies,
+            const FInt32ReadRef& InMRatio,
+            const FInt32ReadRef& InCRatio,
+            const FInt32ReadRef& InModIndex,
+            const FFloatReadRef& InModEnv,
+            const FAudioBufferReadRef& InAmpEnv);
+
+        virtual FDataReferenceCollection GetInputs() const override;
+        virtual FDataReferenceCollection GetOutputs() const override;
+        void Execute();
+
+        // Number of jobs a block is split into, for reporting.
+        int32 GetNumJobs() const { return NumJobs; }
+
+    private:
+
+        void RenderJob(int32 Job);
+
+        // Params.
+        FInt32ReadRef NumVoicesInput;
+        FBoolReadRef Parallel;
+        TArray<FFloatReadRef> Frequencies;
+        FInt32ReadRef MRatio;
+        FInt32ReadRef CRatio;
+        FInt32ReadRef ModIndex;
+        FFloatReadRef ModEnv;
+        FAudioBufferReadRef AmpEnv;
+
+        // Voice count and job split are latched at creation.
+        int32 NumVoices = FMVoicePool::MinVoices;
+        int32 NumJobs = 1;
+        int32 NumFrames = 0;
+
+        // One FM Generator per voice. Job N renders voices N, N + NumJobs, ... into its own slice of JobMix.
+        TArray<TUniquePtr<FFMGeneratorOperator>> Voices;
+        TArray<FAudioBufferReadRef> VoiceOutputs;
+        TArray<float> JobMix;
+
+        // Outputs
+        FAudioBufferWriteRef AudioOutput;
+    };
+
+    // Facade Declaration.
+    class FFMVoicePoolNode : public FNodeFacade
+    {
+    public:
+        // Constructor used by the Metasound Frontend.
+        FFMVoicePoolNode(const FNodeInitData& InitData);
+    };
+}